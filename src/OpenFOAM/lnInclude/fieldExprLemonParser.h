@@ -0,0 +1 @@
+../expressions/fields/fieldExprLemonParser.h
\ No newline at end of file
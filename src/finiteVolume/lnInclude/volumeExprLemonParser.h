@@ -0,0 +1 @@
+../expressions/volume/volumeExprLemonParser.h
\ No newline at end of file